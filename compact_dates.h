@@ -0,0 +1,112 @@
+/*
+ Copyright (C) 2019-2023 Fredrik Öhrström (gpl-3.0-or-later)
+ Copyright (C) 2022 Kajetan Krykwiński (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Decoding and formatting of the compact dates found in manufacturer
+// specific payloads (Techem, Apator, Diehl...). Formatting writes the
+// digits directly, so no printf is needed for these dates.
+
+#include<stdint.h>
+#include<string>
+
+struct PackedDate
+{
+    int year;
+    int month;
+    int day;
+};
+
+// The common 16 bit packing: day in bits 0-4, month in bits 5-8 and
+// years since 2000 from bit 9 and up. Drivers differ in how many year
+// bits are valid, hence the year_mask.
+inline PackedDate decodePackedDate(uint16_t packed, uint16_t year_mask)
+{
+    PackedDate d;
+    d.year = 2000 + ((packed >> 9) & year_mask);
+    d.month = (packed >> 5) & 0x0F;
+    d.day = packed & 0x1F;
+    return d;
+}
+
+// Append n (0-99) as two decimal digits, like %02d.
+inline void appendTwoDigits(std::string *s, int n)
+{
+    s->push_back('0' + n / 10);
+    s->push_back('0' + n % 10);
+}
+
+// Append a byte as two upper case hex digits, like %02X. A valid BCD
+// byte thus appears as its two decimal digits.
+inline void appendHexByte(std::string *s, uint8_t b)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    s->push_back(digits[b >> 4]);
+    s->push_back(digits[b & 0x0F]);
+}
+
+// Append "-MM-DD", month and day must be 0-99.
+inline void appendMonthDay(std::string *s, int month, int day)
+{
+    s->push_back('-');
+    appendTwoDigits(s, month);
+    s->push_back('-');
+    appendTwoDigits(s, day);
+}
+
+// Format YYYY-MM-DD, the year is printed like %d.
+inline std::string isoDate(int year, int month, int day)
+{
+    std::string s;
+    if (year >= 1000 && year <= 9999)
+    {
+        appendTwoDigits(&s, year / 100);
+        appendTwoDigits(&s, year % 100);
+    }
+    else
+    {
+        s = std::to_string(year);
+    }
+    appendMonthDay(&s, month, day);
+    return s;
+}
+
+inline std::string isoDate(const PackedDate &d)
+{
+    return isoDate(d.year, d.month, d.day);
+}
+
+// Append the fixed T02:00:00Z time the proprietary drivers put on dates
+// that carry no time of day.
+inline void appendT0200(std::string *s)
+{
+    s->append("T02:00:00Z");
+}
+
+// Format YYYY-MM-DDT02:00:00Z.
+inline std::string isoDateT0200(int year, int month, int day)
+{
+    std::string s = isoDate(year, month, day);
+    appendT0200(&s);
+    return s;
+}
+
+inline std::string isoDateT0200(const PackedDate &d)
+{
+    return isoDateT0200(d.year, d.month, d.day);
+}
@@ -17,6 +17,7 @@
 */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 namespace
 {
@@ -169,14 +170,7 @@ namespace
             return "";
         }
 
-        uint day = date_curr & 0x1F;
-        uint month = (date_curr >> 5) & 0x0F;
-        uint year = ((date_curr >> 9) & 0x1F) + 2000;
-
-        char buf[30];
-        // is there a better way to construct a date from this?
-        std::snprintf(buf, sizeof(buf), "%d-%02d-%02dT02:00:00Z", year, month, day);
-        return buf;
+        return isoDateT0200(decodePackedDate(date_curr, 0x1F));
     }
 }
 
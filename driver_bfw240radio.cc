@@ -19,6 +19,13 @@
 
 namespace
 {
+    const char *const prev_names_[18] =
+    {
+        "prev_01", "prev_02", "prev_03", "prev_04", "prev_05", "prev_06",
+        "prev_07", "prev_08", "prev_09", "prev_10", "prev_11", "prev_12",
+        "prev_13", "prev_14", "prev_15", "prev_16", "prev_17", "prev_18"
+    };
+
     struct Driver : public virtual MeterCommonImplementation
     {
         Driver(MeterInfo &mi, DriverInfo &di);
@@ -52,10 +59,9 @@ namespace
 
         for (int i=0; i<18; ++i)
         {
-            std::string info = tostrprintf("prev_%02d", i+1);
             std::string about = tostrprintf("Energy consumption %d months ago.", i+1);
 
-            addNumericField(info,
+            addNumericField(prev_names_[i],
                             Quantity::HCA,
                             DEFAULT_PRINT_PROPERTIES,
                             about);
@@ -134,9 +140,8 @@ namespace
 
         for (int i=0; i<18; ++i)
         {
-            std::string info = tostrprintf("prev_%02d", i+1);
             double historic_hca = getHistoric(i, content);
-            setNumericValue(info, Unit::HCA, historic_hca);
+            setNumericValue(prev_names_[i], Unit::HCA, historic_hca);
         }
     }
 }
@@ -16,6 +16,7 @@
 */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 namespace
 {
@@ -26,7 +27,6 @@ namespace
     private:
 
         void processContent(Telegram *t);
-        std::string leadingZeroString(int num);
     };
 
     static bool ok = registerDriver([](DriverInfo&di)
@@ -94,16 +94,13 @@ namespace
 
         uchar date_prev_lo = content[1];
         uchar date_prev_hi = content[2];
-        int date_prev = (256.0*date_prev_hi+date_prev_lo);
+        PackedDate date_prev = decodePackedDate(256*date_prev_hi+date_prev_lo, 0x3F);
 
-        int day_prev = (date_prev >> 0) & 0x1F;
-        int month_prev = (date_prev >> 5) & 0x0F;
-        int year_prev = 2000 + ((date_prev >> 9) & 0x3F);
+        int day_prev = date_prev.day;
+        int month_prev = date_prev.month;
+        int year_prev = date_prev.year;
 
-        std::string previous_date =
-            std::to_string(year_prev) + "-" +
-            leadingZeroString(month_prev) + "-" +
-            leadingZeroString(day_prev) + "T02:00:00Z";
+        std::string previous_date = isoDateT0200(date_prev);
 
         setStringValue("previous_date", previous_date, NULL);
 
@@ -142,10 +139,7 @@ namespace
             year_curr++;
         }
 
-        std::string current_date =
-            std::to_string(year_curr) + "-" +
-            leadingZeroString(month_curr) + "-" +
-            leadingZeroString(day_curr) + "T02:00:00Z";
+        std::string current_date = isoDateT0200(year_curr, month_curr, day_curr);
 
         setStringValue("current_date", current_date, NULL);
 
@@ -209,11 +203,6 @@ namespace
         t->addSpecialExplanation(t->header_size+offset+2, 2, KindOfData::CONTENT, Understanding::FULL,
                                  info.c_str(), temp_radiator_c);
     }
-
-    std::string Driver::leadingZeroString(int num) {
-        std::string new_num = (num < 10 ? "0": "") + std::to_string(num);
-        return new_num;
-    }
 }
 
 // Test: Room fhkvdataiii 11776622 NOKEY
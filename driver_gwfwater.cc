@@ -19,6 +19,20 @@
 
 namespace
 {
+    struct MfctStatusName
+    {
+        uchar flag;
+        const char *name;
+    };
+
+    const MfctStatusName mfct_status_names_[] =
+    {
+        { 0x02, "CONTINUOUS_FLOW" },
+        { 0x08, "BROKEN_PIPE" },
+        { 0x20, "BATTERY_LOW" },
+        { 0x40, "BACKFLOW" },
+    };
+
     struct Driver : public virtual MeterCommonImplementation
     {
         Driver(MeterInfo &mi, DriverInfo &di);
@@ -83,10 +97,14 @@ namespace
 
         std::string info;
 
-        if (a & 0x02) info += "CONTINUOUS_FLOW ";
-        if (a & 0x08) info += "BROKEN_PIPE ";
-        if (a & 0x20) info += "BATTERY_LOW ";
-        if (a & 0x40) info += "BACKFLOW ";
+        for (const MfctStatusName &n : mfct_status_names_)
+        {
+            if (a & n.flag)
+            {
+                info += n.name;
+                info += " ";
+            }
+        }
 
         if (info.size() > 0) info.pop_back();
         setStringValue("mfct_status", info, NULL);
@@ -16,6 +16,7 @@
  */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 #include<string.h>
 
@@ -243,10 +244,13 @@ namespace {
                     bytes[i],
                     bytes[i + 1], bytes[i + 2], leak_day, leak_month,
                     leak_year);
-            char buffer[17];
-            memset(buffer, 0, sizeof(buffer));
-            snprintf(buffer, 16, "%02X.%02X.20%02X", leak_day, leak_month, leak_year);
-            setStringValue("leak_date", buffer);
+            std::string leak_date;
+            appendHexByte(&leak_date, leak_day);
+            leak_date += '.';
+            appendHexByte(&leak_date, leak_month);
+            leak_date += ".20";
+            appendHexByte(&leak_date, leak_year);
+            setStringValue("leak_date", leak_date);
 
             i += 3;
         }
@@ -19,24 +19,54 @@
 
 #include"meters_common_implementation.h"
 #include"manufacturer_specificities.h"
+#include"compact_dates.h"
 
 namespace
 {
-    /** Contains all the booleans required to store the alarms of a PRIOS device. */
-    struct IzarAlarms
+    /** The alarm bits of a PRIOS device, kept where they are found in frame bytes 11, 12 and 13. */
+    constexpr uint32_t IZAR_ALARM_GENERAL                     = 0x800000; // frame[11] bit 7
+    constexpr uint32_t IZAR_ALARM_LEAKAGE_CURRENTLY           = 0x008000; // frame[12] bit 7
+    constexpr uint32_t IZAR_ALARM_LEAKAGE_PREVIOUSLY          = 0x004000;
+    constexpr uint32_t IZAR_ALARM_METER_BLOCKED               = 0x002000;
+    constexpr uint32_t IZAR_ALARM_BACK_FLOW                   = 0x000080; // frame[13] bit 7
+    constexpr uint32_t IZAR_ALARM_UNDERFLOW                   = 0x000040;
+    constexpr uint32_t IZAR_ALARM_OVERFLOW                    = 0x000020;
+    constexpr uint32_t IZAR_ALARM_SUBMARINE                   = 0x000010;
+    constexpr uint32_t IZAR_ALARM_SENSOR_FRAUD_CURRENTLY      = 0x000008;
+    constexpr uint32_t IZAR_ALARM_SENSOR_FRAUD_PREVIOUSLY     = 0x000004;
+    constexpr uint32_t IZAR_ALARM_MECHANICAL_FRAUD_CURRENTLY  = 0x000002;
+    constexpr uint32_t IZAR_ALARM_MECHANICAL_FRAUD_PREVIOUSLY = 0x000001;
+
+    constexpr uint32_t IZAR_ALARMS_CURRENT  = IZAR_ALARM_LEAKAGE_CURRENTLY | IZAR_ALARM_METER_BLOCKED | IZAR_ALARM_BACK_FLOW
+                                              | IZAR_ALARM_UNDERFLOW | IZAR_ALARM_OVERFLOW | IZAR_ALARM_SUBMARINE
+                                              | IZAR_ALARM_SENSOR_FRAUD_CURRENTLY | IZAR_ALARM_MECHANICAL_FRAUD_CURRENTLY;
+    constexpr uint32_t IZAR_ALARMS_PREVIOUS = IZAR_ALARM_LEAKAGE_PREVIOUSLY | IZAR_ALARM_SENSOR_FRAUD_PREVIOUSLY
+                                              | IZAR_ALARM_MECHANICAL_FRAUD_PREVIOUSLY;
+    constexpr uint32_t IZAR_ALARMS_ALL      = IZAR_ALARM_GENERAL | IZAR_ALARMS_CURRENT | IZAR_ALARMS_PREVIOUS;
+
+    struct IzarAlarmName
     {
-        bool general_alarm;
-        bool leakage_currently;
-        bool leakage_previously;
-        bool meter_blocked;
-        bool back_flow;
-        bool underflow;
-        bool overflow;
-        bool submarine;
-        bool sensor_fraud_currently;
-        bool sensor_fraud_previously;
-        bool mechanical_fraud_currently;
-        bool mechanical_fraud_previously;
+        uint32_t flag;
+        const char *name;
+    };
+
+    const IzarAlarmName current_alarm_names_[] =
+    {
+        { IZAR_ALARM_LEAKAGE_CURRENTLY,          "leakage" },
+        { IZAR_ALARM_METER_BLOCKED,              "meter_blocked" },
+        { IZAR_ALARM_BACK_FLOW,                  "back_flow" },
+        { IZAR_ALARM_UNDERFLOW,                  "underflow" },
+        { IZAR_ALARM_OVERFLOW,                   "overflow" },
+        { IZAR_ALARM_SUBMARINE,                  "submarine" },
+        { IZAR_ALARM_SENSOR_FRAUD_CURRENTLY,     "sensor_fraud" },
+        { IZAR_ALARM_MECHANICAL_FRAUD_CURRENTLY, "mechanical_fraud" },
+    };
+
+    const IzarAlarmName previous_alarm_names_[] =
+    {
+        { IZAR_ALARM_LEAKAGE_PREVIOUSLY,          "leakage" },
+        { IZAR_ALARM_SENSOR_FRAUD_PREVIOUSLY,     "sensor_fraud" },
+        { IZAR_ALARM_MECHANICAL_FRAUD_PREVIOUSLY, "mechanical_fraud" },
     };
 
     struct Driver : public virtual MeterCommonImplementation
@@ -47,8 +77,8 @@ namespace
 
     private:
 
-        std::string currentAlarmsText(IzarAlarms &alarms);
-        std::string previousAlarmsText(IzarAlarms &alarms);
+        std::string currentAlarmsText(uint32_t alarms);
+        std::string previousAlarmsText(uint32_t alarms);
 
         std::vector<uchar> decodePrios(const std::vector<uchar> &origin, const std::vector<uchar> &payload, uint32_t key);
 
@@ -128,70 +158,52 @@ namespace
                        DEFAULT_PRINT_PROPERTIES);
     }
 
-    std::string Driver::currentAlarmsText(IzarAlarms &alarms)
+    template<size_t N>
+    std::string alarmsText(uint32_t alarms, const IzarAlarmName (&names)[N])
     {
         std::string s;
-        if (alarms.leakage_currently) {
-            s.append("leakage,");
-        }
-        if (alarms.meter_blocked) {
-            s.append("meter_blocked,");
-        }
-        if (alarms.back_flow) {
-            s.append("back_flow,");
-        }
-        if (alarms.underflow) {
-            s.append("underflow,");
-        }
-        if (alarms.overflow) {
-            s.append("overflow,");
-        }
-        if (alarms.submarine) {
-            s.append("submarine,");
-        }
-        if (alarms.sensor_fraud_currently) {
-            s.append("sensor_fraud,");
-        }
-        if (alarms.mechanical_fraud_currently) {
-            s.append("mechanical_fraud,");
-        }
-        if (s.length() > 0) {
-            if (alarms.general_alarm) {
-                return "general_alarm";
+        for (const IzarAlarmName &n : names)
+        {
+            if (alarms & n.flag)
+            {
+                s.append(n.name);
+                s.append(",");
             }
-            s.pop_back();
-            return s;
         }
-        return "no_alarm";
+        if (s.length() > 0) s.pop_back();
+        return s;
     }
 
-    std::string Driver::previousAlarmsText(IzarAlarms &alarms)
+    std::string Driver::currentAlarmsText(uint32_t alarms)
     {
-        std::string s;
-        if (alarms.leakage_previously) {
-            s.append("leakage,");
-        }
-        if (alarms.sensor_fraud_previously) {
-            s.append("sensor_fraud,");
+        if ((alarms & IZAR_ALARMS_CURRENT) == 0)
+        {
+            return "no_alarm";
         }
-        if (alarms.mechanical_fraud_previously) {
-            s.append("mechanical_fraud,");
+        if (alarms & IZAR_ALARM_GENERAL)
+        {
+            return "general_alarm";
         }
-        if (s.length() > 0) {
-            s.pop_back();
-            return s;
+        return alarmsText(alarms, current_alarm_names_);
+    }
+
+    std::string Driver::previousAlarmsText(uint32_t alarms)
+    {
+        if ((alarms & IZAR_ALARMS_PREVIOUS) == 0)
+        {
+            return "no_alarm";
         }
-        return "no_alarm";
+        return alarmsText(alarms, previous_alarm_names_);
     }
 
     void Driver::processContent(Telegram *t)
     {
-        std::vector<uchar> frame;
-        t->extractFrame(&frame);
-        std::vector<uchar> origin = t->original.empty() ? frame : t->original;
+        // Decode straight from the telegram buffers, the LFSR decoder only reads them.
+        const std::vector<uchar> &frame = t->frame;
+        const std::vector<uchar> &origin = t->original.empty() ? frame : t->original;
 
         std::vector<uchar> decoded_content;
-        for (auto& key : keys) {
+        for (uint32_t key : keys) {
             decoded_content = decodePrios(origin, frame, key);
             if (!decoded_content.empty())
                 break;
@@ -256,24 +268,11 @@ namespace
             uint8_t h0_month = decoded_content[10] & 0xF;
             uint8_t h0_day = decoded_content[9] & 0x1F;
 
-            setStringValue("last_month_measure_date", tostrprintf("%d-%02d-%02d", h0_year, h0_month%99, h0_day%99), NULL);
+            setStringValue("last_month_measure_date", isoDate(h0_year, h0_month, h0_day), NULL);
         }
 
         // read the alarms:
-        IzarAlarms alarms {};
-
-        alarms.general_alarm = frame[11] >> 7;
-        alarms.leakage_currently = frame[12] >> 7;
-        alarms.leakage_previously = frame[12] >> 6 & 0x1;
-        alarms.meter_blocked = frame[12] >> 5 & 0x1;
-        alarms.back_flow = frame[13] >> 7;
-        alarms.underflow = frame[13] >> 6 & 0x1;
-        alarms.overflow = frame[13] >> 5 & 0x1;
-        alarms.submarine = frame[13] >> 4 & 0x1;
-        alarms.sensor_fraud_currently = frame[13] >> 3 & 0x1;
-        alarms.sensor_fraud_previously = frame[13] >> 2 & 0x1;
-        alarms.mechanical_fraud_currently = frame[13] >> 1 & 0x1;
-        alarms.mechanical_fraud_previously = frame[13] & 0x1;
+        uint32_t alarms = (frame[11] << 16 | frame[12] << 8 | frame[13]) & IZAR_ALARMS_ALL;
 
         setStringValue("current_alarms", currentAlarmsText(alarms));
         setStringValue("previous_alarms", previousAlarmsText(alarms));
@@ -16,6 +16,7 @@
 */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 namespace
 {
@@ -71,12 +72,8 @@ namespace
         t->extractPayload(&content);
 
         // Previous date
-        uint16_t prev_date = (content[2] << 8) | content[1];
-        uint prev_date_day = (prev_date >> 0) & 0x1F;
-        uint prev_date_month = (prev_date >> 5) & 0x0F;
-        uint prev_date_year = (prev_date >> 9) & 0x3F;
-        setStringValue("prev_date",
-                       tostrprintf("%d-%02d-%02dT02:00:00Z", prev_date_year+2000, prev_date_month, prev_date_day));
+        PackedDate prev_date = decodePackedDate((content[2] << 8) | content[1], 0x3F);
+        setStringValue("prev_date", isoDateT0200(prev_date));
 
         // Previous consumption
         uchar prev_lo = content[3];
@@ -87,9 +84,10 @@ namespace
         uint16_t current_date = (content[6] << 8) | content[5];
         uint current_date_day = (current_date >> 4) & 0x1F;
         uint current_date_month = (current_date >> 9) & 0x0F;
-        setStringValue("current_date",
-                       tostrprintf("%s-%02d-%02dT02:00:00Z",
-                                   currentYear().c_str(), current_date_month, current_date_day));
+        std::string current_date_str = currentYear();
+        appendMonthDay(&current_date_str, current_date_month, current_date_day);
+        appendT0200(&current_date_str);
+        setStringValue("current_date", current_date_str);
 
         // Current consumption
         uchar curr_lo = content[7];
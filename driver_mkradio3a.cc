@@ -16,9 +16,16 @@
 */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 namespace
 {
+    const char *const last_month_names_[12] =
+    {
+        "last_dec", "last_jan", "last_feb", "last_mar", "last_apr", "last_may",
+        "last_jun", "last_jul", "last_aug", "last_sep", "last_oct", "last_nov"
+    };
+
     struct Driver : public virtual MeterCommonImplementation
     {
         Driver(MeterInfo &mi, DriverInfo &di);
@@ -126,11 +133,10 @@ namespace
         t->extractPayload(&content);
 
         // Current date
-        uint16_t curr_date = (content[3] << 8) | content[2];
-        uint curr_date_day = (curr_date >> 0) & 0x1F;
-        uint curr_date_month = (curr_date >> 5) & 0x0F;
-        uint curr_date_year = (curr_date >> 9) & 0xFF;
-        setStringValue("target_date", tostrprintf("%d-%02d-%02dT02:00:00Z", curr_date_year+2000, curr_date_month, curr_date_day));
+        PackedDate curr_date = decodePackedDate((content[3] << 8) | content[2], 0xFF);
+        uint curr_date_day = curr_date.day;
+        uint curr_date_month = curr_date.month;
+        setStringValue("target_date", isoDateT0200(curr_date));
 
         // Previous consumption
         // uchar prev_lo = content[8];
@@ -145,7 +151,8 @@ namespace
         setNumericValue("total", Unit::M3, total_water_consumption_m3);
 
 
-        double* prev_month = new double[20];
+        // Consumption per calendar month, indexed by month%12 (0 is December).
+        double prev_month[12] = {};
         double curr_month_m3;
 
         // Current & Prev Month consumption
@@ -228,18 +235,10 @@ namespace
            prev_month[ (curr_date_month + 12 - 11) % 12 ] = (prev_hi+prev_lo)/10.0;
         }
         setNumericValue("target", Unit::M3, curr_month_m3);
-        setNumericValue("last_jan", Unit::M3, prev_month[1]);
-        setNumericValue("last_feb", Unit::M3, prev_month[2]);
-        setNumericValue("last_mar", Unit::M3, prev_month[3]);
-        setNumericValue("last_apr", Unit::M3, prev_month[4]);
-        setNumericValue("last_may", Unit::M3, prev_month[5]);
-        setNumericValue("last_jun", Unit::M3, prev_month[6]);
-        setNumericValue("last_jul", Unit::M3, prev_month[7]);
-        setNumericValue("last_aug", Unit::M3, prev_month[8]);
-        setNumericValue("last_sep", Unit::M3, prev_month[9]);
-        setNumericValue("last_oct", Unit::M3, prev_month[10]);
-        setNumericValue("last_nov", Unit::M3, prev_month[11]);
-        setNumericValue("last_dec", Unit::M3, prev_month[0]);
+        for (int m = 1; m <= 12; ++m)
+        {
+            setNumericValue(last_month_names_[m % 12], Unit::M3, prev_month[m % 12]);
+        }
     }
 }
 
@@ -156,10 +156,10 @@ namespace
 
     void Driver::processContent(Telegram *t) {
         auto it = t->dv_entries.find("0779");
-        if (it != t->dv_entries.end()) {
-            std::vector<uchar> v;
-            auto entry = it->second.second;
-            hex2bin(entry.value.substr(0, 8), &v);
+        // Decode the tpl id, mfct, version and type in one go.
+        std::vector<uchar> v;
+        if (it != t->dv_entries.end() && hex2bin(it->second.second.value.substr(0, 16), &v) && v.size() == 8) {
+            const DVEntry &entry = it->second.second;
             // FIXME PROBLEM
             Address a;
             a.id = tostrprintf("%02x%02x%02x%02x", v[3], v[2], v[1], v[0]);
@@ -167,22 +167,16 @@ namespace
             std::string info = "*** " + entry.value.substr(0, 8) + " tpl-id (" + t->addresses.back().id + ")";
             t->addSpecialExplanation(entry.offset, 4, KindOfData::CONTENT, Understanding::FULL, info.c_str());
 
-            v.clear();
-            hex2bin(entry.value.substr(8, 4), &v);
-            uint16_t tpl_mfct = *(uint16_t *) (&v[0]);
+            uint16_t tpl_mfct = v[5] << 8 | v[4];
             info = "*** " + entry.value.substr(8, 4) + " tpl-mfct (" + manufacturerFlag(tpl_mfct) + ")";
             t->addSpecialExplanation(entry.offset + 4, 2, KindOfData::PROTOCOL, Understanding::FULL, info.c_str());
 
-            v.clear();
-            hex2bin(entry.value.substr(12, 2), &v);
-            uint8_t tpl_version = v[0];
+            uint8_t tpl_version = v[6];
             info = "*** " + entry.value.substr(12, 2) + " tpl-version";
             t->addSpecialExplanation(entry.offset + 6, 1, KindOfData::PROTOCOL, Understanding::FULL, info.c_str());
 
-            v.clear();
-            hex2bin(entry.value.substr(14, 2), &v);
-            uint8_t tpl_type = v[0];
-            info = "*** " + entry.value.substr(14, 2) + " tpl-type (" + mediaType(v[0], tpl_mfct) + ")";
+            uint8_t tpl_type = v[7];
+            info = "*** " + entry.value.substr(14, 2) + " tpl-type (" + mediaType(tpl_type, tpl_mfct) + ")";
             t->addSpecialExplanation(entry.offset + 7, 1, KindOfData::PROTOCOL, Understanding::FULL, info.c_str());
 
             t->tpl_id_found = true;
@@ -19,6 +19,43 @@
 
 namespace
 {
+    // Older BMT meters xor some payload bytes with a key byte found in the frame
+    // and with one row of a fixed vector table, selected by the low nibble of
+    // the key byte. Describe such a field with a constexpr XorVectorObfuscation
+    // and call decode on the frame to get the plain bytes.
+    template<size_t N>
+    struct XorVectorObfuscation
+    {
+        size_t key_offset;
+        size_t data_offset;
+        uchar vectors[16][N];
+
+        bool decode(const std::vector<uchar> &frame, uchar (&out)[N]) const
+        {
+            if (frame.size() < data_offset + N || frame.size() <= key_offset) return false;
+
+            uchar key = frame[key_offset];
+            const uchar *vector = vectors[key & 0x0f];
+            const uchar *data = &frame[data_offset];
+            for (size_t i = 0; i < N; ++i)
+            {
+                out[i] = (uchar)(data[i] ^ key ^ vector[i]);
+            }
+            return true;
+        }
+    };
+
+    constexpr XorVectorObfuscation<6> legacy_total_ =
+    {
+        0x0b, 0x0f,
+        { { 117, 150, 122, 16, 26, 10 }, { 91, 127, 112, 19, 34, 19 }, { 179, 24, 185, 11, 142, 153 },
+          { 142, 125, 121, 7, 74, 22 }, { 181, 145, 7, 154, 203, 105 }, { 184, 163, 50, 161, 57, 14 },
+          { 189, 128, 156, 126, 96, 153 }, { 39, 92, 180, 196, 128, 163 }, { 48, 208, 10, 206, 25, 3 },
+          { 194, 76, 240, 5, 165, 134 }, { 84, 75, 22, 152, 17, 94 }, { 75, 238, 12, 201, 125, 162 },
+          { 135, 202, 74, 72, 228, 31 }, { 196, 135, 119, 46, 138, 232 }, { 227, 48, 189, 120, 87, 140 },
+          { 164, 154, 57, 111, 40, 5 } }
+    };
+
     struct Driver : public virtual MeterCommonImplementation
     {
         Driver(MeterInfo &mi, DriverInfo &di);
@@ -58,28 +95,27 @@ namespace
             .set(VIFRange::DateTime));
     }
 
-    uchar decode_vectors_[16][6] = { { 117, 150, 122, 16, 26, 10 }, { 91, 127, 112, 19, 34, 19 }, { 179, 24, 185, 11, 142, 153 },
-                                     { 142, 125, 121, 7, 74, 22 }, { 181, 145, 7, 154, 203, 105 }, { 184, 163, 50, 161, 57, 14 },
-                                     { 189, 128, 156, 126, 96, 153 }, { 39, 92, 180, 196, 128, 163 }, { 48, 208, 10, 206, 25, 3 },
-                                     { 194, 76, 240, 5, 165, 134 }, { 84, 75, 22, 152, 17, 94 }, { 75, 238, 12, 201, 125, 162 },
-                                     { 135, 202, 74, 72, 228, 31 }, { 196, 135, 119, 46, 138, 232 }, { 227, 48, 189, 120, 87, 140 },
-                                     { 164, 154, 57, 111, 40, 5 } };
-
     void Driver::processContent(Telegram *t)
     {
         if (t->tpl_cfg == 0x1006)
         {
             // This is the old type of meter and some values needs to be de-obfuscated.
-            std::vector<uchar> frame;
-            t->extractFrame(&frame);
+            const std::vector<uchar> &frame = t->frame;
 
             debugPayload("(rftx1) decoding raw frame", frame);
 
-            uchar decoded_total[6];
+            int o = 28; // Offset to datetime.
+            if (frame.size() < (size_t)(o + 6))
+            {
+                debug("(rftx1) frame too short for datetime\n");
+                return;
+            }
 
-            for (int i = 0; i < 6; ++i)
+            uchar decoded_total[6];
+            if (!legacy_total_.decode(frame, decoded_total))
             {
-                decoded_total[i] = (uchar)(frame[0xf + i] ^ frame[0xb] ^ decode_vectors_[frame[0xb] & 0x0f][i]);
+                debug("(rftx1) frame too short for obfuscated total\n");
+                return;
             }
 
             double total = 0;
@@ -91,7 +127,6 @@ namespace
             }
             setNumericValue("total", Unit::M3, total/1000.0);
 
-            int o = 28; // Offset to datetime.
             int y = 2000+bcd2bin(frame[o+5]);
             int M = bcd2bin(frame[o+4]);
             int d = bcd2bin(frame[o+3]);
@@ -16,6 +16,7 @@
 */
 
 #include"meters_common_implementation.h"
+#include"compact_dates.h"
 
 namespace
 {
@@ -71,13 +72,8 @@ namespace
             setStringValue("status", "OK");
         }
 
-        uint16_t prev_date = (data[2] << 8) | data[1];
-        uint prev_date_day = (prev_date >> 0) & 0x1F;
-        uint prev_date_month = (prev_date >> 5) & 0x0F;
-        uint prev_date_year = (prev_date >> 9) & 0x3F;
-
-        setStringValue("prev_date",
-                       tostrprintf("%d-%02d-%02dT02:00:00Z", prev_date_year+2000, prev_date_month, prev_date_day));
+        PackedDate prev_date = decodePackedDate((data[2] << 8) | data[1], 0x3F);
+        setStringValue("prev_date", isoDateT0200(prev_date));
     }
 }
 